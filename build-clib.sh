@@ -20,6 +20,107 @@ PACKAGE_DIR=$(dirname "$0")
 cd "$PACKAGE_DIR"
 pushd .
 
+# prebuilt fetch mode: PREBUILT=1 downloads a checksummed prebuilt static
+# library for the host triple instead of compiling from source, falling back
+# to the source build when no matching artifact is available
+PREBUILT=0
+PREBUILT_TAG="${PREBUILT_TAG:-prebuilt-latest}"
+PREBUILT_BASE_URL="${PREBUILT_BASE_URL:-https://github.com/redthing1/raylib-nuklear/releases/download}"
+for arg in $BUILD_ARGS; do
+    case "$arg" in
+        PREBUILT=1) PREBUILT=1 ;;
+        RELEASE_SIMD=1) RELEASE_SIMD=1 ;;
+        RELEASE_LTO=1) RELEASE_LTO=1 ;;
+    esac
+done
+
+# nuklear compile-time options the D binding's declarations and struct
+# layouts assume; these are NOT optional flavors. NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+# provides nk_convert/nk__draw_* and embeds nk_draw_list in nk_context, which
+# the bound nk_context in source/nuklear.d mirrors. NK_ZERO_COMMAND_MEMORY
+# zeroes command allocations so NuklearFrameChanged's byte compare of the
+# command buffer is deterministic (uninitialized struct padding would
+# otherwise make identical frames compare unequal).
+BINDING_CFLAGS="-DNK_INCLUDE_VERTEX_BUFFER_OUTPUT -DNK_ZERO_COMMAND_MEMORY"
+
+# SIMD build flavor: compile the C library (nuklear's nk_convert vertex
+# packing is the hot loop) with auto-vectorization enabled for the host's
+# baseline SIMD ISA (SSE4.1 on x86_64; NEON is already baseline on aarch64)
+if [ "${RELEASE_SIMD:-0}" = "1" ]; then
+    SIMD_CFLAGS="-O3 -ftree-vectorize"
+    case "$(uname -m)" in
+        x86_64|amd64) SIMD_CFLAGS="$SIMD_CFLAGS -msse4.1" ;;
+    esac
+fi
+
+# LTO build flavor: let the compiler inline across the nuklear single-header
+# and the raylib-nuklear glue. -ffat-lto-objects keeps regular object code in
+# the archive alongside the LTO sections, so the D link works with a plain
+# ar/ld that has no LTO plugin. -fno-math-errno is the safe slice of
+# -ffast-math for ui geometry (no errno bookkeeping on sqrtf and friends)
+# without changing NaN/inf semantics.
+if [ "${RELEASE_LTO:-0}" = "1" ]; then
+    LTO_CFLAGS="-O3 -flto -ffat-lto-objects -fno-math-errno"
+fi
+
+ALL_EXTRA_CFLAGS="$BINDING_CFLAGS${SIMD_CFLAGS:+ $SIMD_CFLAGS}${LTO_CFLAGS:+ $LTO_CFLAGS}"
+BUILD_ARGS="$BUILD_ARGS EXTRA_CFLAGS=\"$ALL_EXTRA_CFLAGS\""
+
+# the binding calls nk_convert/nk__draw_*, so an archive built without the
+# vertex-buffer define fails at app link with confusing errors; catch it here
+verify_lib() {
+    if ! command -v nm > /dev/null 2>&1; then
+        return 0
+    fi
+    if ! nm "$1" 2> /dev/null | grep -q ' T nk_convert$'; then
+        echo "[$HOST] ERROR: $1 is missing nk_convert:"
+        echo "[$HOST]   the library was not compiled with $BINDING_CFLAGS and does not match the D binding"
+        return 1
+    fi
+    return 0
+}
+
+fetch_prebuilt() {
+    local triple="$(uname -s | tr '[:upper:]' '[:lower:]')-$(uname -m)"
+    local artifact="${LIB_NAME}-${triple}.a"
+    local url="$PREBUILT_BASE_URL/$PREBUILT_TAG/$artifact"
+
+    echo "[$HOST] fetching prebuilt $LIB_NAME for $triple"
+    if ! curl -fsSL "$url" -o "$LIB_FILE_1.download"; then
+        echo "[$HOST] no prebuilt artifact at $url"
+        return 1
+    fi
+    if ! curl -fsSL "$url.sha256" -o "$LIB_FILE_1.download.sha256"; then
+        echo "[$HOST] no checksum for prebuilt artifact, refusing to use it"
+        rm -f "$LIB_FILE_1.download"
+        return 1
+    fi
+    local want_sum have_sum
+    want_sum=$(awk '{print $1}' "$LIB_FILE_1.download.sha256")
+    have_sum=$(sha256sum "$LIB_FILE_1.download" | awk '{print $1}')
+    rm -f "$LIB_FILE_1.download.sha256"
+    if [ "$want_sum" != "$have_sum" ]; then
+        echo "[$HOST] checksum mismatch for prebuilt artifact (want $want_sum, have $have_sum)"
+        rm -f "$LIB_FILE_1.download"
+        return 1
+    fi
+    if ! verify_lib "$LIB_FILE_1.download"; then
+        rm -f "$LIB_FILE_1.download"
+        return 1
+    fi
+    mv -f "$LIB_FILE_1.download" "$LIB_FILE_1"
+    echo "[$HOST] using prebuilt $LIB_FILE_1 ($want_sum)"
+    return 0
+}
+
+if [ "$PREBUILT" = "1" ] && fetch_prebuilt; then
+    popd
+    exit 0
+fi
+if [ "$PREBUILT" = "1" ]; then
+    echo "[$HOST] prebuilt fetch failed, falling back to source build"
+fi
+
 echo "[$HOST] building $LIB_NAME library..."
 
 # delete $SOURCETREE_DIR to force re-fetch source
@@ -35,18 +136,40 @@ fi
 cd $SOURCETREE_DIR
 git submodule update --init --recursive
 
-echo "[$HOST] starting build of $LIB_NAME" 
+# all injected flags (binding defines, SIMD/LTO flavors) ride the Makefile's
+# EXTRA_CFLAGS variable; if the fetched checkout does not consume it the
+# build would silently produce a plain release, which is worse than failing
+if ! grep -qs 'EXTRA_CFLAGS' Makefile makefile GNUmakefile; then
+    echo "[$HOST] ERROR: the fetched $SOURCETREE_DIR Makefile does not consume EXTRA_CFLAGS"
+    echo "[$HOST]   requested flags ($ALL_EXTRA_CFLAGS) would be dropped silently; refusing to build"
+    exit 1
+fi
+
+echo "[$HOST] starting build of $LIB_NAME"
 #
 # START BUILD
 #
 # build the library
 make clean
-make -j$(nproc) $BUILD_ARGS
+eval make -j$(nproc) $BUILD_ARGS
 #
 # END BUILD
 #
 
-echo "[$HOST] finished build of $LIB_NAME" 
+verify_lib "$LIB_FILE_1"
+
+# RELEASE_LTO must not silently degrade to a plain -O3 build: fat LTO
+# objects carry their IR in .gnu.lto_* (gcc) / .llvm.lto (clang >= 17)
+# sections, so their absence means the flags were not applied
+if [ "${RELEASE_LTO:-0}" = "1" ] && command -v readelf > /dev/null 2>&1; then
+    if ! readelf -S "$LIB_FILE_1" 2> /dev/null | grep -q '\.gnu\.lto\|\.llvm\.lto'; then
+        echo "[$HOST] ERROR: RELEASE_LTO=1 was requested but $LIB_FILE_1 contains no LTO sections"
+        echo "[$HOST]   the compiler did not receive the LTO flags; refusing to ship a plain build"
+        exit 1
+    fi
+fi
+
+echo "[$HOST] finished build of $LIB_NAME"
 
 echo "[$HOST] copying $LIB_NAME binary ($LIB_FILE_1) to $PACKAGE_DIR"
 ln -vrfs $(pwd)/$LIB_FILE_1 $PACKAGE_DIR/$LIB_FILE_1